@@ -20,6 +20,9 @@ using namespace Gdiplus;
 #include <ctime>
 #include <thread>
 #include <chrono>
+#include <memory>
+#include <atomic>
+#include <mutex>
 
 using namespace std;
 namespace fs = std::filesystem;
@@ -77,6 +80,112 @@ struct Module {
     vector<Func> funcs;
 };
 
+// Frozen function/operator table shared by every engine built on it.
+struct Registry {
+    vector<Op> ops;
+    vector<Func> funcs;
+
+    void registerModule(const Module& m) {
+        for (auto& o : m.ops) ops.push_back(o);
+        for (auto& f : m.funcs) funcs.push_back(f);
+    }
+};
+
+// --- Instrumentation ---
+
+// Always-on execution counters, shared by every engine in the process.
+struct ExecStats {
+    atomic<uint64_t> tokensLexed{0};
+    atomic<uint64_t> executeCalls{0};
+    atomic<uint64_t> funcDispatches{0};
+    atomic<uint64_t> varLookups{0};
+    atomic<uint64_t> varMisses{0};
+    atomic<uint64_t> listAllocs{0};
+    atomic<uint64_t> tableAllocs{0};
+    atomic<uint64_t> prmLoads{0};
+    atomic<uint64_t> fileIncludes{0};
+
+    static void bump(atomic<uint64_t>& c) { c.fetch_add(1, memory_order_relaxed); }
+
+    vector<pair<string, uint64_t>> snapshot() const {
+        return {
+            {"tokens_lexed", tokensLexed.load(memory_order_relaxed)},
+            {"execute_calls", executeCalls.load(memory_order_relaxed)},
+            {"func_dispatches", funcDispatches.load(memory_order_relaxed)},
+            {"var_lookups", varLookups.load(memory_order_relaxed)},
+            {"var_misses", varMisses.load(memory_order_relaxed)},
+            {"list_allocs", listAllocs.load(memory_order_relaxed)},
+            {"table_allocs", tableAllocs.load(memory_order_relaxed)},
+            {"prm_loads", prmLoads.load(memory_order_relaxed)},
+            {"file_includes", fileIncludes.load(memory_order_relaxed)},
+        };
+    }
+
+    void dump(ostream& out) const {
+        out << "[Stats]";
+        for (auto& [name, value] : snapshot()) out << " " << name << "=" << value;
+        out << endl;
+    }
+};
+
+inline ExecStats g_stats;
+
+// Optional Chrome trace-event recorder (enabled by --trace), loadable in chrome://tracing or Perfetto.
+class Tracer {
+    struct Event { string name; string cat; long long ts; long long dur; };
+    static inline mutex mtx;
+    static inline vector<Event> events;
+    static inline const auto origin = chrono::steady_clock::now();
+public:
+    static inline atomic<bool> enabled{false};
+
+    static long long nowUs() {
+        return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - origin).count();
+    }
+
+    static void record(string name, string cat, long long ts, long long dur) {
+        lock_guard<mutex> lock(mtx);
+        events.push_back({std::move(name), std::move(cat), ts, dur});
+    }
+
+    static string escape(const string& s) {
+        string out;
+        for (char c : s) {
+            if (c == '"' || c == '\\') { out += '\\'; out += c; }
+            else if ((unsigned char)c < 0x20) out += ' ';
+            else out += c;
+        }
+        return out;
+    }
+
+    static bool write(const string& path) {
+        lock_guard<mutex> lock(mtx);
+        ofstream out(path);
+        if (!out) return false;
+        out << "{\"traceEvents\":[";
+        for (size_t i = 0; i < events.size(); ++i) {
+            auto& e = events[i];
+            out << (i ? ",\n" : "\n") << "{\"name\":\"" << escape(e.name) << "\",\"cat\":\"" << e.cat
+                << "\",\"ph\":\"X\",\"ts\":" << e.ts << ",\"dur\":" << e.dur << ",\"pid\":1,\"tid\":1}";
+        }
+        out << "\n]}" << endl;
+        return true;
+    }
+};
+
+// Records one complete ("X") event covering its own lifetime, including exits by exception.
+struct TraceSpan {
+    string name, cat;
+    long long start = -1;
+    TraceSpan(const char* category, const string& spanName) {
+        if (!Tracer::enabled.load(memory_order_relaxed)) return;
+        name = spanName; cat = category; start = Tracer::nowUs();
+    }
+    ~TraceSpan() {
+        if (start >= 0) Tracer::record(std::move(name), std::move(cat), start, Tracer::nowUs() - start);
+    }
+};
+
 // --- Lexer ---
 
 enum Prl_TokenType {
@@ -94,6 +203,17 @@ class Lexer {
 public:
     Lexer(string source) : src(source) {}
     Prl_Token nextToken() {
+        ExecStats::bump(g_stats.tokensLexed);
+        return scan();
+    }
+    Prl_Token peekToken() {
+        size_t oldPos = pos;
+        Prl_Token t = scan();
+        pos = oldPos;
+        return t;
+    }
+private:
+    Prl_Token scan() {
         while (pos < src.size()) {
             if (isspace(src[pos])) { pos++; continue; }
             if (src[pos] == '/' && pos + 1 < src.size() && src[pos+1] == '/') {
@@ -139,12 +259,6 @@ public:
         string op(1, src[pos++]);
         return {T_OPERATOR, op};
     }
-    Prl_Token peekToken() {
-        size_t oldPos = pos;
-        Prl_Token t = nextToken();
-        pos = oldPos;
-        return t;
-    }
 };
 
 // --- Engine ---
@@ -153,6 +267,8 @@ class ParlelEngine {
 public:
     map<string, variant<float, string>> variables;
     map<string, variant<float, string>> defines;
+    // Read-only builtins shared between engines; ops/funcs below are this engine's own overlay.
+    shared_ptr<const Registry> base;
     vector<Op> ops;
     vector<Func> funcs;
     set<string> includedFiles;
@@ -164,37 +280,49 @@ public:
     static inline map<float, map<string, variant<float, string>>> prl_tables;
     static inline float next_handle = 1.0f;
 
-    ParlelEngine() {
+    ParlelEngine() : base(builtins()) {}
+    explicit ParlelEngine(shared_ptr<const Registry> registry) : base(std::move(registry)) {}
+
+    // Core builtins, built once on first use and shared by all default-constructed engines.
+    static const shared_ptr<const Registry>& builtins() {
+        static const shared_ptr<const Registry> shared = make_shared<const Registry>(coreRegistry());
+        return shared;
+    }
+
+    // Fresh copy of the core table, for hosts that want to add their own builtins before freezing it.
+    static Registry coreRegistry() {
+        Registry r;
+
         // Default Operators
-        ops.push_back({'+', 1, [](variant<float, string> a, variant<float, string> b) -> variant<float, string> {
+        r.ops.push_back({'+', 1, [](variant<float, string> a, variant<float, string> b) -> variant<float, string> {
             if (holds_alternative<float>(a) && holds_alternative<float>(b)) return variant<float,string>(get<float>(a) + get<float>(b));
             string sa = holds_alternative<string>(a) ? get<string>(a) : to_string(get<float>(a));
             string sb = holds_alternative<string>(b) ? get<string>(b) : to_string(get<float>(b));
             return variant<float,string>(sa + sb);
         }});
-        ops.push_back({'-', 1, [](variant<float, string> a, variant<float, string> b) -> variant<float, string> { return variant<float,string>(get<float>(a) - get<float>(b)); }});
-        ops.push_back({'*', 2, [](variant<float, string> a, variant<float, string> b) -> variant<float, string> { return variant<float,string>(get<float>(a) * get<float>(b)); }});
-        ops.push_back({'/', 2, [](variant<float, string> a, variant<float, string> b) -> variant<float, string> { return variant<float,string>(get<float>(a) / get<float>(b)); }});
+        r.ops.push_back({'-', 1, [](variant<float, string> a, variant<float, string> b) -> variant<float, string> { return variant<float,string>(get<float>(a) - get<float>(b)); }});
+        r.ops.push_back({'*', 2, [](variant<float, string> a, variant<float, string> b) -> variant<float, string> { return variant<float,string>(get<float>(a) * get<float>(b)); }});
+        r.ops.push_back({'/', 2, [](variant<float, string> a, variant<float, string> b) -> variant<float, string> { return variant<float,string>(get<float>(a) / get<float>(b)); }});
 
         // --- Core Functions (formerly in VanillaP) ---
         
-        funcs.push_back({"inc", 1, [](ParlelEngine* eng, auto v) {
+        r.funcs.push_back({"inc", 1, [](ParlelEngine* eng, auto v) {
             eng->runFile(get<string>(v[0]));
             return 0.0f;
         }});
 
-        funcs.push_back({"mod", 1, [](ParlelEngine* eng, auto v) {
+        r.funcs.push_back({"mod", 1, [](ParlelEngine* eng, auto v) {
             eng->loadModule(get<string>(v[0]));
             return 0.0f;
         }});
 
         // Logic
-        funcs.push_back({"if_prl", 3, [](ParlelEngine* eng, auto v) {
+        r.funcs.push_back({"if_prl", 3, [](ParlelEngine* eng, auto v) {
             float condition = holds_alternative<float>(v[0]) ? get<float>(v[0]) : (get<string>(v[0]).empty() ? 0.0f : 1.0f);
             return eng->execute(get<string>(condition != 0.0f ? v[1] : v[2]));
         }});
 
-        funcs.push_back({"while_prl", 2, [](ParlelEngine* eng, auto v) {
+        r.funcs.push_back({"while_prl", 2, [](ParlelEngine* eng, auto v) {
             string cond_code = get<string>(v[0]);
             string body_code = get<string>(v[1]);
             variant<float, string> last_res = 0.0f;
@@ -207,7 +335,7 @@ public:
             return last_res;
         }});
 
-        funcs.push_back({"for_prl", 4, [](ParlelEngine* eng, auto v) {
+        r.funcs.push_back({"for_prl", 4, [](ParlelEngine* eng, auto v) {
             string var_name = get<string>(v[0]);
             float start = get<float>(v[1]), end = get<float>(v[2]);
             string body = get<string>(v[3]);
@@ -220,34 +348,40 @@ public:
         }});
 
         // Comparisons
-        funcs.push_back({"eq", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(v[0] == v[1] ? 1.0f : 0.0f); }});
-        funcs.push_back({"lt", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { 
+        r.funcs.push_back({"eq", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(v[0] == v[1] ? 1.0f : 0.0f); }});
+        r.funcs.push_back({"lt", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { 
             if (holds_alternative<float>(v[0]) && holds_alternative<float>(v[1])) return variant<float,string>(get<float>(v[0]) < get<float>(v[1]) ? 1.0f : 0.0f);
             return variant<float,string>(0.0f);
         }});
-        funcs.push_back({"gt", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { 
+        r.funcs.push_back({"gt", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { 
             if (holds_alternative<float>(v[0]) && holds_alternative<float>(v[1])) return variant<float,string>(get<float>(v[0]) > get<float>(v[1]) ? 1.0f : 0.0f);
             return variant<float,string>(0.0f);
         }});
 
         // Math
-        funcs.push_back({"math_sin", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(sinf(get<float>(v[0]))); }});
-        funcs.push_back({"math_cos", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(cosf(get<float>(v[0]))); }});
-        funcs.push_back({"math_tan", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(tanf(get<float>(v[0]))); }});
-        funcs.push_back({"math_pow", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(powf(get<float>(v[0]), get<float>(v[1]))); }});
-        funcs.push_back({"math_sqrt", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(sqrtf(get<float>(v[0]))); }});
-        funcs.push_back({"math_abs", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(fabsf(get<float>(v[0]))); }});
-        funcs.push_back({"math_rand", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>((float)rand()/(float)RAND_MAX); }});
-        funcs.push_back({"math_min", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { float a=get<float>(v[0]), b=get<float>(v[1]); return a < b ? a : b; }});
-        funcs.push_back({"math_max", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { float a=get<float>(v[0]), b=get<float>(v[1]); return a > b ? a : b; }});
+        r.funcs.push_back({"math_sin", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(sinf(get<float>(v[0]))); }});
+        r.funcs.push_back({"math_cos", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(cosf(get<float>(v[0]))); }});
+        r.funcs.push_back({"math_tan", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(tanf(get<float>(v[0]))); }});
+        r.funcs.push_back({"math_pow", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(powf(get<float>(v[0]), get<float>(v[1]))); }});
+        r.funcs.push_back({"math_sqrt", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(sqrtf(get<float>(v[0]))); }});
+        r.funcs.push_back({"math_abs", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>(fabsf(get<float>(v[0]))); }});
+        r.funcs.push_back({"math_rand", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return variant<float,string>((float)rand()/(float)RAND_MAX); }});
+        r.funcs.push_back({"math_min", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { float a=get<float>(v[0]), b=get<float>(v[1]); return a < b ? a : b; }});
+        r.funcs.push_back({"math_max", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { float a=get<float>(v[0]), b=get<float>(v[1]); return a > b ? a : b; }});
         
         // System
-        funcs.push_back({"sys_sleep", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { std::this_thread::sleep_for(std::chrono::milliseconds((long long)get<float>(v[0]))); return 0.0f; }});
-        funcs.push_back({"sys_time", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return (float)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }});
+        r.funcs.push_back({"sys_sleep", 1, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { std::this_thread::sleep_for(std::chrono::milliseconds((long long)get<float>(v[0]))); return 0.0f; }});
+        r.funcs.push_back({"sys_stats", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> {
+            ExecStats::bump(g_stats.tableAllocs); float h = next_handle++; auto& t = prl_tables[h];
+            // Floats are exact only up to 2^24, so every counter is also stored as a decimal string under "<name>_str"
+            for (auto& [name, value] : g_stats.snapshot()) { t[name] = (float)value; t[name + "_str"] = to_string(value); }
+            return h;
+        }});
+        r.funcs.push_back({"sys_time", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return (float)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }});
 
         // GUI (Native Windows GDI+)
 #ifdef _WIN32
-        funcs.push_back({"gui_init", 2, [](ParlelEngine* eng, vector<variant<float, string>> v) -> variant<float, string> {
+        r.funcs.push_back({"gui_init", 2, [](ParlelEngine* eng, vector<variant<float, string>> v) -> variant<float, string> {
             if (g_hWnd) return 1.0f;
             g_width = (int)get<float>(v[0]); g_height = (int)get<float>(v[1]);
             GdiplusStartupInput si; GdiplusStartup(&gdiplusToken, &si, NULL);
@@ -258,49 +392,64 @@ public:
             SelectObject(g_hdcBuffer, g_hbmBuffer); ReleaseDC(g_hWnd, hdc);
             return 1.0f;
         }});
-        funcs.push_back({"gui_clear", 3, [](ParlelEngine* eng, vector<variant<float, string>> v) -> variant<float, string> { Graphics g(g_hdcBuffer); g.Clear(Color(255, (BYTE)get<float>(v[0]), (BYTE)get<float>(v[1]), (BYTE)get<float>(v[2]))); return 1.0f; }});
-        funcs.push_back({"gui_rect", 7, [](ParlelEngine* eng, vector<variant<float, string>> v) -> variant<float, string> {
+        r.funcs.push_back({"gui_clear", 3, [](ParlelEngine* eng, vector<variant<float, string>> v) -> variant<float, string> { Graphics g(g_hdcBuffer); g.Clear(Color(255, (BYTE)get<float>(v[0]), (BYTE)get<float>(v[1]), (BYTE)get<float>(v[2]))); return 1.0f; }});
+        r.funcs.push_back({"gui_rect", 7, [](ParlelEngine* eng, vector<variant<float, string>> v) -> variant<float, string> {
             Graphics g(g_hdcBuffer); g.SetSmoothingMode(SmoothingModeAntiAlias);
             SolidBrush b(Color(255, (BYTE)get<float>(v[4]), (BYTE)get<float>(v[5]), (BYTE)get<float>(v[6])));
             g.FillRectangle(&b, (REAL)get<float>(v[0]), (REAL)get<float>(v[1]), (REAL)get<float>(v[2]), (REAL)get<float>(v[3]));
             return 1.0f;
         }});
-        funcs.push_back({"gui_text", 6, [](ParlelEngine* eng, vector<variant<float, string>> v) -> variant<float, string> {
+        r.funcs.push_back({"gui_text", 6, [](ParlelEngine* eng, vector<variant<float, string>> v) -> variant<float, string> {
             Graphics g(g_hdcBuffer); FontFamily ff(L"Arial"); Font f(&ff, 14, FontStyleRegular, UnitPoint);
             SolidBrush b(Color(255, (BYTE)get<float>(v[3]), (BYTE)get<float>(v[4]), (BYTE)get<float>(v[5])));
             string txt = get<string>(v[2]); wstring wtxt(txt.begin(), txt.end());
             g.DrawString(wtxt.c_str(), -1, &f, PointF((REAL)get<float>(v[0]), (REAL)get<float>(v[1])), &b);
             return 1.0f;
         }});
-        funcs.push_back({"gui_update", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { InvalidateRect(g_hWnd, NULL, FALSE); MSG msg; while(PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) { TranslateMessage(&msg); DispatchMessage(&msg); } return 0.0f; }});
-        funcs.push_back({"gui_should_close", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return (float)!IsWindow(g_hWnd); }});
+        r.funcs.push_back({"gui_update", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { InvalidateRect(g_hWnd, NULL, FALSE); MSG msg; while(PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) { TranslateMessage(&msg); DispatchMessage(&msg); } return 0.0f; }});
+        r.funcs.push_back({"gui_should_close", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { return (float)!IsWindow(g_hWnd); }});
 #endif
 
         // Data structures
-        funcs.push_back({"list_new", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { float h = next_handle++; prl_lists[h] = {}; return h; }});
-        funcs.push_back({"list_add", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { prl_lists[get<float>(v[0])].push_back(v[1]); return v[1]; }});
-        funcs.push_back({"list_set", 3, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { 
+        r.funcs.push_back({"list_new", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { ExecStats::bump(g_stats.listAllocs); float h = next_handle++; prl_lists[h] = {}; return h; }});
+        r.funcs.push_back({"list_add", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { prl_lists[get<float>(v[0])].push_back(v[1]); return v[1]; }});
+        r.funcs.push_back({"list_set", 3, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { 
             float h = get<float>(v[0]); int i = (int)get<float>(v[1]);
             if(prl_lists.count(h) && i>=0 && i<(int)prl_lists[h].size()) prl_lists[h][i] = v[2];
             return v[2];
         }});
-        funcs.push_back({"list_get", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { auto& l = prl_lists[get<float>(v[0])]; int i = (int)get<float>(v[1]); return (i>=0 && i<(int)l.size())?l[i]:0.0f; }});
+        r.funcs.push_back({"list_get", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { auto& l = prl_lists[get<float>(v[0])]; int i = (int)get<float>(v[1]); return (i>=0 && i<(int)l.size())?l[i]:0.0f; }});
         
-        funcs.push_back({"table_new", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { float h = next_handle++; prl_tables[h] = {}; return h; }});
-        funcs.push_back({"table_set", 3, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { prl_tables[get<float>(v[0])][get<string>(v[1])] = v[2]; return v[2]; }});
-        funcs.push_back({"table_get", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { auto& t = prl_tables[get<float>(v[0])]; string k = get<string>(v[1]); return t.count(k)?t[k]:0.0f; }});
+        r.funcs.push_back({"table_new", 0, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { ExecStats::bump(g_stats.tableAllocs); float h = next_handle++; prl_tables[h] = {}; return h; }});
+        r.funcs.push_back({"table_set", 3, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { prl_tables[get<float>(v[0])][get<string>(v[1])] = v[2]; return v[2]; }});
+        r.funcs.push_back({"table_get", 2, [](ParlelEngine* e, vector<variant<float, string>> v) -> variant<float, string> { auto& t = prl_tables[get<float>(v[0])]; string k = get<string>(v[1]); return t.count(k)?t[k]:0.0f; }});
 
         // PRM Custom Function Definer
-        funcs.push_back({"def_prl", 3, [](ParlelEngine* eng, auto v) {
+        r.funcs.push_back({"def_prl", 3, [](ParlelEngine* eng, auto v) {
             string name = get<string>(v[0]), params_raw = get<string>(v[1]), body = get<string>(v[2]);
             vector<string> params; stringstream ss(params_raw); string p;
             while(getline(ss, p, ',')) { p.erase(0, p.find_first_not_of(" ")); p.erase(p.find_last_not_of(" ") + 1); if(!p.empty()) params.push_back(p); }
-            eng->funcs.push_back({name, (int)params.size(), [params, body](ParlelEngine* e, auto vals) {
+            eng->funcs.push_back({name, (int)params.size(), [name, params, body](ParlelEngine* e, auto vals) {
+                TraceSpan span("func", name);
                 for (size_t i = 0; i < params.size(); ++i) e->variables[params[i]] = vals[i];
                 return e->execute(body);
             }});
             return 1.0f;
         }});
+
+        return r;
+    }
+
+    const Func* findFunc(const string& name) const {
+        for (auto& f : base->funcs) if (f.FuncProfile == name) return &f;
+        for (auto& f : funcs) if (f.FuncProfile == name) return &f;
+        return nullptr;
+    }
+
+    const Op* findOp(char opChar) const {
+        for (auto& op : base->ops) if (op.OpProfile == opChar) return &op;
+        for (auto& op : ops) if (op.OpProfile == opChar) return &op;
+        return nullptr;
     }
 
     void registerModule(const Module& m) {
@@ -310,6 +459,7 @@ public:
 
     void loadModule(string modName) {
         if (loadedModules.count(modName)) return;
+        TraceSpan span("loadModule", modName);
 
         std::filesystem::path scriptDir(currentScriptDir);
         vector<std::filesystem::path> searchPaths = {
@@ -328,6 +478,7 @@ public:
 
         if (!found) throw runtime_error("Module not found: " + modName);
 
+        ExecStats::bump(g_stats.prmLoads);
         ifstream f(prmPath, ios::binary);
         uint32_t magic; f.read((char*)&magic, 4);
         if (magic != 0x50524D31) throw runtime_error("Invalid .prm format");
@@ -346,7 +497,8 @@ public:
                 uint32_t codeLen; f.read((char*)&codeLen, 4);
                 string code(codeLen, '\0'); f.read(&code[0], codeLen);
                 
-                funcs.push_back({name, (int)argCount, [code, argCount](ParlelEngine* eng, auto args) {
+                funcs.push_back({name, (int)argCount, [name, code, argCount](ParlelEngine* eng, auto args) {
+                    TraceSpan span("func", name);
                     // Map args to arg0, arg1, etc.
                     for (int j = 0; j < (int)argCount && j < (int)args.size(); ++j) {
                         string argName = "arg" + to_string(j);
@@ -376,6 +528,8 @@ public:
         string absPath = std::filesystem::absolute(filePath).string();
         if (includedFiles.count(absPath)) return;
         includedFiles.insert(absPath);
+        ExecStats::bump(g_stats.fileIncludes);
+        TraceSpan span("runFile", absPath);
 
         string oldDir = currentScriptDir;
         currentScriptDir = filePath.parent_path().string();
@@ -430,11 +584,16 @@ variant<float, string> ParlelEngine::factor(Lexer& lex, Prl_Token& curr) {
                 }
             }
             eat(lex, curr, T_RPAREN);
-            for (auto& f : funcs) if (f.FuncProfile == name) return f.call(this, args);
+            if (const Func* f = findFunc(name)) {
+                ExecStats::bump(g_stats.funcDispatches);
+                return f->call(this, args);
+            }
             throw runtime_error("Fonksiyon bulunamadı: " + name);
         } else {
+            ExecStats::bump(g_stats.varLookups);
             if (variables.count(name)) return variables[name];
             if (defines.count(name)) return defines[name];
+            ExecStats::bump(g_stats.varMisses);
             return name;
         }
     }
@@ -447,7 +606,7 @@ variant<float, string> ParlelEngine::term(Lexer& lex, Prl_Token& curr) {
         char opChar = curr.value[0];
         eat(lex, curr, T_OPERATOR);
         auto right = factor(lex, curr);
-        for (auto& op : ops) if (op.OpProfile == opChar) { node = op.call(node, right); break; }
+        if (const Op* op = findOp(opChar)) node = op->call(node, right);
     }
     return node;
 }
@@ -469,12 +628,13 @@ variant<float, string> ParlelEngine::expression(Lexer& lex, Prl_Token& curr) {
         char opChar = curr.value[0];
         eat(lex, curr, T_OPERATOR);
         auto right = term(lex, curr);
-        for (auto& op : ops) if (op.OpProfile == opChar) { node = op.call(node, right); break; }
+        if (const Op* op = findOp(opChar)) node = op->call(node, right);
     }
     return node;
 }
 
 variant<float, string> ParlelEngine::execute(const string& input) {
+    ExecStats::bump(g_stats.executeCalls);
     Lexer lexer(input);
     Prl_Token curr = lexer.nextToken();
     variant<float, string> last_res = 0.0f;
@@ -1,10 +1,11 @@
 #include "core.hpp"
 
 int main(int argc, char* argv[]) {
-    ParlelEngine engine;
+    // Builtins are added once to a shared registry; engines only hold a pointer to it
+    Registry registry = ParlelEngine::coreRegistry();
 
     // Register builtin utility functions
-    engine.funcs.push_back({"print", 1, [](ParlelEngine* eng, auto v) {
+    registry.funcs.push_back({"print", 1, [](ParlelEngine* eng, auto v) {
         if (holds_alternative<float>(v[0])) cout << get<float>(v[0]) << endl;
         else cout << get<string>(v[0]) << endl;
         return 0.0f;
@@ -15,20 +16,45 @@ int main(int argc, char* argv[]) {
         eng->variables[get<string>(v[0])] = v[1];
         return v[1];
     };
-    engine.funcs.push_back({"var", 2, varFunc});
-    engine.funcs.push_back({"varible", 2, varFunc});
-    engine.funcs.push_back({"define", 2, [](ParlelEngine* eng, auto v) {
+    registry.funcs.push_back({"var", 2, varFunc});
+    registry.funcs.push_back({"varible", 2, varFunc});
+    registry.funcs.push_back({"define", 2, [](ParlelEngine* eng, auto v) {
         eng->defines[get<string>(v[0])] = v[1];
         return v[1];
     }});
 
     // Developers can register their own modules here
-    // engine.registerModule(...)
+    // registry.registerModule(...)
 
-    string targetFile;
-    if (argc > 1) {
-        targetFile = argv[1];
-    } else {
+    ParlelEngine engine(make_shared<const Registry>(std::move(registry)));
+
+    string targetFile, tracePath;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--trace") {
+            if (i + 1 >= argc) {
+                cerr << "Kullanim: parlel [--trace <cikti.json>] <dosya.prl>" << endl;
+                cerr << "Hata: --trace bir dosya yolu bekliyor" << endl;
+                return 1;
+            }
+            tracePath = argv[++i];
+        } else if (targetFile.empty()) {
+            targetFile = arg;
+        } else {
+            cerr << "Kullanim: parlel [--trace <cikti.json>] <dosya.prl>" << endl;
+            cerr << "Hata: fazladan arguman: " << arg << endl;
+            return 1;
+        }
+    }
+    if (!tracePath.empty()) Tracer::enabled = true;
+
+    // Counter dump and trace file are written however the run ends
+    auto finish = [&]() {
+        g_stats.dump(cerr);
+        if (!tracePath.empty() && !Tracer::write(tracePath)) cerr << "Hata: trace dosyasi yazilamadi: " << tracePath << endl;
+    };
+
+    if (targetFile.empty()) {
         cout << "Lutfen calisitirmak istediginiz .prl dosyasinin yolunu girin: ";
         getline(cin, targetFile);
     }
@@ -41,6 +67,7 @@ int main(int argc, char* argv[]) {
         } catch (const exception& e) {
             cout << "Hata: " << e.what() << endl;
         }
+        finish();
         return 0;
     }
     else {
@@ -48,5 +75,6 @@ int main(int argc, char* argv[]) {
         getline(cin, targetFile);
     }
 
+    finish();
     return 0;
 }